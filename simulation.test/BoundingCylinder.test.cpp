@@ -50,6 +50,18 @@ SCENARIO("Using BoundingCylinder::Contains function", "[BoundingCylinder]") {
                 REQUIRE(sut->Contains(dc) == false);
             }
         }
+        WHEN("A point just inside the cylinder's bottom face is tested") {
+            auto dc = DoubleCoordinate(0, 0, 1 - epsilon);
+            THEN("Contains() returns true") {
+                REQUIRE(sut->Contains(dc) == true);
+            }
+        }
+        WHEN("A point just below the cylinder is tested") {
+            auto dc = DoubleCoordinate(0, 0, 1 + epsilon);
+            THEN("Contains() returns false") {
+                REQUIRE(sut->Contains(dc) == false);
+            }
+        }
         WHEN("Points just inside the curved wall of the cylinder are tested") {
             auto dc1 = DoubleCoordinate(1 - epsilon, 0, 0.5);
             auto xOnCircle = 0.2;
@@ -73,6 +85,74 @@ SCENARIO("Using BoundingCylinder::Contains function", "[BoundingCylinder]") {
     }
 }
 
+SCENARIO("Using BoundingCylinder::Contains function over a grid of points", "[BoundingCylinder]") {
+    GIVEN("A BoundingCylinder away from the origin is defined") {
+        auto top = 0.5;
+        auto depth = 2.0;
+        auto radius = 1.5;
+        auto sut = new BoundingCylinder(42, DoubleCoordinate(2, -3, top), depth, radius, "fake algo", 77, 88, 99, 111, 222, 333);
+        WHEN("Points on a grid around the cylinder are tested") {
+            // Points lying on a face or on the curved wall are left to the edge scenarios above.
+            auto clearance = 0.000001;
+            THEN("Contains() agrees with the radial distance and depth of each point") {
+                for (auto x = 0.0; x <= 4.0; x += 0.25) {
+                    for (auto y = -5.0; y <= -1.0; y += 0.25) {
+                        for (auto z = 0.0; z <= 3.0; z += 0.25) {
+                            auto radialSquared = (x - 2) * (x - 2) + (y + 3) * (y + 3);
+                            if (fabs(z - top) < clearance || fabs(z - top - depth) < clearance || fabs(radialSquared - radius * radius) < clearance) {
+                                continue;
+                            }
+                            auto expected = z > top && z < top + depth && radialSquared < radius * radius;
+                            CAPTURE(x, y, z);
+                            REQUIRE(sut->Contains(DoubleCoordinate(x, y, z)) == expected);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Using BoundingCylinder functions far from the origin", "[BoundingCylinder]") {
+    GIVEN("A BoundingCylinder with large coordinates is defined") {
+        auto offset = 1000000.0;
+        auto margin = 0.001;
+        auto sut = new BoundingCylinder(42, DoubleCoordinate(offset, offset, offset), 1, 1, "fake algo", 77, 88, 99, 111, 222, 333);
+        WHEN("Points clearly inside the cylinder are tested") {
+            auto dc1 = DoubleCoordinate(offset + 1 - margin, offset, offset + 0.5);
+            auto dc2 = DoubleCoordinate(offset, offset, offset + margin);
+            auto dc3 = DoubleCoordinate(offset, offset, offset + 1 - margin);
+            THEN("Contains() returns true") {
+                REQUIRE(sut->Contains(dc1) == true);
+                REQUIRE(sut->Contains(dc2) == true);
+                REQUIRE(sut->Contains(dc3) == true);
+            }
+        }
+        WHEN("Points clearly outside the cylinder are tested") {
+            auto dc1 = DoubleCoordinate(offset + 1 + margin, offset, offset + 0.5);
+            auto dc2 = DoubleCoordinate(offset, offset, offset - margin);
+            auto dc3 = DoubleCoordinate(offset, offset, offset + 1 + margin);
+            THEN("Contains() returns false") {
+                REQUIRE(sut->Contains(dc1) == false);
+                REQUIRE(sut->Contains(dc2) == false);
+                REQUIRE(sut->Contains(dc3) == false);
+            }
+        }
+        WHEN("A slightly larger enclosing BoundingCylinder is tested") {
+            auto enclosingCyl = new BoundingCylinder(1, DoubleCoordinate(offset, offset, offset - margin), 1 + 2 * margin, 1 + margin, "fake algo", 77, 88, 99, 111, 222, 333);
+            THEN("Within() returns true") {
+                REQUIRE(sut->Within(enclosingCyl) == true);
+            }
+        }
+        WHEN("A slightly smaller enclosed BoundingCylinder is tested") {
+            auto enclosedCyl = new BoundingCylinder(1, DoubleCoordinate(offset, offset, offset + margin), 1 - 2 * margin, 1 - margin, "fake algo", 77, 88, 99, 111, 222, 333);
+            THEN("Within() returns false") {
+                REQUIRE(sut->Within(enclosedCyl) == false);
+            }
+        }
+    }
+}
+
 SCENARIO("Testing if BoundingCylinder is inside another BoundingCylinder", "[BoundingCylinder]") {
     GIVEN("A BoundingCylinder A is defined") {
         auto sut = new BoundingCylinder(42, DoubleCoordinate(0, 0, 0), 1, 1, "blah", 123, 456, 789, 101112, 131415, 161718);
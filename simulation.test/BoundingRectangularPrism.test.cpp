@@ -51,6 +51,89 @@ SCENARIO("Using BoundingRectangularPrism::Contains function", "[BoundingRectangu
                 REQUIRE(sut->Contains(dc) == false);
             }
         }
+        WHEN("A point just inside the prism's opposite corner is tested") {
+            auto doubleEpsilon = NEAR_AS_INTERSECTING * 2;
+            auto dc = DoubleCoordinate(1 - doubleEpsilon, 1 - doubleEpsilon, 1 - doubleEpsilon);
+            THEN("Contains() returns true") {
+                REQUIRE(sut->Contains(dc) == true);
+            }
+        }
+        WHEN("A point just outside the prism's opposite corner is tested") {
+            auto doubleEpsilon = NEAR_AS_INTERSECTING * 2;
+            auto dc = DoubleCoordinate(1 + doubleEpsilon, 1 + doubleEpsilon, 1 + doubleEpsilon);
+            THEN("Contains() returns false") {
+                REQUIRE(sut->Contains(dc) == false);
+            }
+        }
+        WHEN("Points just outside a single face of the prism are tested") {
+            auto doubleEpsilon = NEAR_AS_INTERSECTING * 2;
+            auto dc1 = DoubleCoordinate(1 + doubleEpsilon, 0.5, 0.5);
+            auto dc2 = DoubleCoordinate(0.5, -doubleEpsilon, 0.5);
+            auto dc3 = DoubleCoordinate(0.5, 0.5, 1 + doubleEpsilon);
+            THEN("Contains() returns false") {
+                REQUIRE(sut->Contains(dc1) == false);
+                REQUIRE(sut->Contains(dc2) == false);
+                REQUIRE(sut->Contains(dc3) == false);
+            }
+        }
+    }
+}
+
+SCENARIO("Using BoundingRectangularPrism::Contains function over a grid of points", "[BoundingRectangularPrism]") {
+    GIVEN("A BoundingRectangularPrism away from the origin is defined") {
+        auto sut = new BoundingRectangularPrism(42, DoubleCoordinate(-1, 2, 0.5), DoubleCoordinate(1.5, 3, 2), "blah", 123, 456, 789, 101112, 131415, 161718);
+        WHEN("Points on a grid around the prism are tested") {
+            // Points lying on a face are left to the near-face scenarios above.
+            auto clearance = 0.000001;
+            THEN("Contains() agrees with a per-axis slab test of each point") {
+                for (auto x = -2.0; x <= 2.5; x += 0.25) {
+                    for (auto y = 1.0; y <= 4.0; y += 0.25) {
+                        for (auto z = 0.0; z <= 2.5; z += 0.25) {
+                            if (fabs(x + 1) < clearance || fabs(x - 1.5) < clearance
+                                || fabs(y - 2) < clearance || fabs(y - 3) < clearance
+                                || fabs(z - 0.5) < clearance || fabs(z - 2) < clearance) {
+                                continue;
+                            }
+                            auto expected = x > -1 && x < 1.5 && y > 2 && y < 3 && z > 0.5 && z < 2;
+                            CAPTURE(x, y, z);
+                            REQUIRE(sut->Contains(DoubleCoordinate(x, y, z)) == expected);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Using BoundingRectangularPrism functions far from the origin", "[BoundingRectangularPrism]") {
+    GIVEN("A BoundingRectangularPrism with large coordinates is defined") {
+        auto offset = 1000000.0;
+        auto margin = 0.001;
+        auto sut = new BoundingRectangularPrism(42, DoubleCoordinate(offset, offset, offset), DoubleCoordinate(offset + 1, offset + 1, offset + 1), "blah", 123, 456, 789, 101112, 131415, 161718);
+        WHEN("A point clearly inside the prism's corner is tested") {
+            auto dc = DoubleCoordinate(offset + margin, offset + margin, offset + margin);
+            THEN("Contains() returns true") {
+                REQUIRE(sut->Contains(dc) == true);
+            }
+        }
+        WHEN("A point clearly outside the prism's corner is tested") {
+            auto dc = DoubleCoordinate(offset - margin, offset - margin, offset - margin);
+            THEN("Contains() returns false") {
+                REQUIRE(sut->Contains(dc) == false);
+            }
+        }
+        WHEN("A slightly larger enclosing BoundingRectangularPrism is tested") {
+            auto enclosingRect = new BoundingRectangularPrism(1, DoubleCoordinate(offset - margin, offset - margin, offset - margin), DoubleCoordinate(offset + 1 + margin, offset + 1 + margin, offset + 1 + margin), "blah", 123, 456, 789, 101112, 131415, 161718);
+            THEN("Within() returns true") {
+                REQUIRE(sut->Within(enclosingRect) == true);
+            }
+        }
+        WHEN("A slightly smaller enclosed BoundingRectangularPrism is tested") {
+            auto enclosedRect = new BoundingRectangularPrism(1, DoubleCoordinate(offset + margin, offset + margin, offset + margin), DoubleCoordinate(offset + 1 - margin, offset + 1 - margin, offset + 1 - margin), "blah", 123, 456, 789, 101112, 131415, 161718);
+            THEN("Within() returns false") {
+                REQUIRE(sut->Within(enclosedRect) == false);
+            }
+        }
     }
 }
 
@@ -1,9 +1,49 @@
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include "catch.hpp"
 #include "simulation/process/modules/VolumeObject.h"
+#include "simulation/process/modules/BoundingCylinder.h"
+#include "simulation/process/modules/BoundingRectangularPrism.h"
 
 using namespace rootmap;
 
 TEST_CASE("VolumeObject's epsilon is small", "[VolumeObject]") {
     REQUIRE(NEAR_AS_INTERSECTING <= 0.00000001);
 }
+
+SCENARIO("Testing a chain of nested VolumeObjects", "[VolumeObject]") {
+    GIVEN("A BoundingCylinder A inside a BoundingRectangularPrism B inside a BoundingCylinder C") {
+        auto innermost = new BoundingCylinder(1, DoubleCoordinate(0, 0, 2), 1, 1, "fake algo", 77, 88, 99, 111, 222, 333);
+        auto middle = new BoundingRectangularPrism(2, DoubleCoordinate(-2, -2, 1), DoubleCoordinate(2, 2, 5), "blah", 123, 456, 789, 101112, 131415, 161718);
+        auto outermost = new BoundingCylinder(3, DoubleCoordinate(0, 0, 0), 10, 10, "fake algo", 77, 88, 99, 111, 222, 333);
+        WHEN("Each object is tested against its enclosing objects") {
+            THEN("Within() returns true for every enclosing object") {
+                REQUIRE(innermost->Within(middle) == true);
+                REQUIRE(middle->Within(outermost) == true);
+                REQUIRE(innermost->Within(outermost) == true);
+            }
+        }
+        WHEN("Each object is tested against the objects it encloses") {
+            THEN("Within() returns false for every enclosed object") {
+                REQUIRE(middle->Within(innermost) == false);
+                REQUIRE(outermost->Within(middle) == false);
+                REQUIRE(outermost->Within(innermost) == false);
+            }
+        }
+        WHEN("A point inside the innermost object is tested") {
+            auto dc = DoubleCoordinate(0.25, 0.25, 2.5);
+            THEN("Contains() returns true for every object in the chain") {
+                REQUIRE(innermost->Contains(dc) == true);
+                REQUIRE(middle->Contains(dc) == true);
+                REQUIRE(outermost->Contains(dc) == true);
+            }
+        }
+        WHEN("A point inside only the outermost object is tested") {
+            auto dc = DoubleCoordinate(5, 0, 8);
+            THEN("Contains() returns true for the outermost object only") {
+                REQUIRE(innermost->Contains(dc) == false);
+                REQUIRE(middle->Contains(dc) == false);
+                REQUIRE(outermost->Contains(dc) == true);
+            }
+        }
+    }
+}